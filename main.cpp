@@ -1,12 +1,33 @@
 #include <fmt/core.h>
 #include <SFML/Graphics.hpp>
 #include <utility>
+#include <algorithm>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <span>
+#include <thread>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <fstream>
 
+#ifdef __linux__
+#include <cerrno>
+#include <filesystem>
+#include <fcntl.h>
+#include <linux/input.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
 enum GameState { MENU, PLAYING, GAME_OVER, PAUSED, SCOREBOARD, SETTINGS };
 enum FontType { BIT_FONT, ARIAL };
 
@@ -41,121 +62,303 @@ std::vector<std::string> loadWords(const std::string& filename) {
     return words;
 }
 
-std::string getRandomWord(const std::vector<std::string>& words) {
-    int index = rand() % words.size();
-    return words[index];
-}
-
-class FallingWord {
+// Rules and state of one game: falling words, typed input, score and lives. Words refer into
+// the dictionary by index, so any number of sessions can share one word list.
+class GameSession {
 public:
-    FallingWord(std::string  word, float x, float y, const sf::Font &font, float speed, int fontSize)
-            : word(std::move(word)), position(x, y), speed(speed), fontSize(fontSize) {
-        text.setFont(font);
-        text.setCharacterSize(fontSize);
-        text.setPosition(position);
-        text.setFillColor(sf::Color::White);
+    struct Word {
+        std::uint64_t id = 0;
+        std::size_t wordIndex = 0;
+        sf::Vector2f position;
+        float speed = 0.0f;
+        std::size_t matchLength = 0;
+    };
+
+    // Words spawn at least `maxWordWidth` away from the right edge so that even the longest one
+    // stays inside the play field.
+    GameSession(const std::vector<std::string>& dictionary, unsigned int seed, float maxWordWidth = 150)
+            : dictionary(dictionary), rng(seed), maxWordWidth(maxWordWidth) {
+    }
+
+    void restart() {
+        currentInput.clear();
+        restore(0, 3);
+    }
+
+    // Puts a saved game back in place of the current one. Typed input is kept, as resuming
+    // from the pause screen should not lose a half-typed word.
+    void restore(int score, int remainingLives) {
+        words.clear();
+        counter = score;
+        lives = remainingLives;
+        state = PLAYING;
+        scoreRecorded = false;
+    }
+
+    // Size of the play field; words spawn across its width and are lost 100px above its bottom.
+    // Words keep their relative spot when it changes, so they stay inside the field.
+    void setSize(sf::Vector2f newSize) {
+        float oldSpawnWidth = getSpawnWidth();
+        float oldFloor = getFloor();
+        size = newSize;
+
+        for (auto& word : words) {
+            word.position.x *= getSpawnWidth() / oldSpawnWidth;
+            word.position.y *= getFloor() / oldFloor;
+        }
+    }
 
-        matchedText.setFont(font);
-        matchedText.setCharacterSize(fontSize);
-        matchedText.setPosition(position);
-        matchedText.setFillColor(sf::Color::Green);
+    void addWord(std::size_t wordIndex, sf::Vector2f position, float speed) {
+        Word word;
+        word.id = nextWordId++;
+        word.wordIndex = wordIndex;
+        word.position = position;
+        word.speed = speed;
+        word.matchLength = getMatchLength(dictionary[wordIndex]);
+        words.push_back(word);
+    }
+
+    void handleText(std::uint32_t unicode) {
+        if (state != PLAYING) {
+            return;
+        }
+
+        if (unicode == '\b') { // backspace
+            if (!currentInput.empty()) {
+                currentInput.pop_back();
+            }
+        } else if (unicode == '\r') { // enter
+            for (auto it = words.begin(); it != words.end(); ++it) {
+                const std::string& word = dictionary[it->wordIndex];
+                if (word == currentInput) {
+                    if (word.size() < 6) {
+                        counter++;
+                    } else if (word.size() < 10) {
+                        counter += 2;
+                    } else {
+                        counter += 3;
+                    }
+                    words.erase(it);
+                    currentInput.clear();
+                    break;
+                }
+            }
+        } else if (unicode >= 32 && unicode < 128) {
+            currentInput += static_cast<char>(unicode);
+        }
     }
 
+    // Touches nothing outside this session, so separate sessions can update on separate threads.
     void update(float deltaTime) {
-        position.y += speed * deltaTime;
-        text.setPosition(position);
-        matchedText.setPosition(position);
+        if (state != PLAYING) {
+            return;
+        }
+
+        if (rng() % static_cast<unsigned int>(std::max(1, 300 - counter * 2)) < 1.5) {
+            float x = static_cast<float>(rng() % static_cast<unsigned int>(getSpawnWidth()));
+            addWord(rng() % dictionary.size(), {x, 0.0f}, 70.0f + counter);
+        }
+
+        advance(deltaTime);
+
+        // collision with the bottom
+        for (auto it = words.begin(); it != words.end(); ) {
+            if (it->position.y >= getFloor()) {
+                lives--;
+                if (lives == 0) {
+                    state = GAME_OVER;
+                    break;
+                }
+                it = words.erase(it);  // Remove word that reached the bottom
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Moves every word and refreshes its highlight, without spawning or losing any.
+    void advance(float deltaTime) {
+        for (auto& word : words) {
+            word.position.y += word.speed * deltaTime;
+            word.matchLength = getMatchLength(dictionary[word.wordIndex]);
+        }
+    }
+
+    const std::vector<std::string>& getDictionary() const {
+        return dictionary;
+    }
+
+    const std::vector<Word>& getWords() const {
+        return words;
     }
 
-    bool checkCollision(float windowHeight) const {
-        return position.y >= windowHeight - 100;
+    const std::string& getWord(const Word& word) const {
+        return dictionary[word.wordIndex];
     }
 
-    sf::Text getText() const {
-        return text;
+    const std::string& getInput() const {
+        return currentInput;
     }
 
-    const sf::Text& getMatchedText() {
-        return matchedText;
+    int getScore() const {
+        return counter;
     }
 
-    const std::string& getWord() const {
-        return word;
+    int getLives() const {
+        return lives;
     }
 
-    float getSpeed() const {
-        return speed;
+    bool isGameOver() const {
+        return state == GAME_OVER;
     }
 
-    void highlight(const std::string& input) {
+    // True exactly once per finished game, so the score is recorded a single time.
+    bool takeFinalScore(int& score) {
+        if (state != GAME_OVER || scoreRecorded) {
+            return false;
+        }
+        scoreRecorded = true;
+        score = counter;
+        return true;
+    }
+
+private:
+    float getSpawnWidth() const {
+        return std::max(1.0f, size.x - maxWordWidth);
+    }
+
+    float getFloor() const {
+        return std::max(1.0f, size.y - 100);
+    }
+
+    std::size_t getMatchLength(const std::string& word) const {
         size_t matchLength = 0;
-        for (size_t i = 0; i < std::min(input.size(), word.size()); ++i) {
-            if (input[i] == word[i]) {
+        for (size_t i = 0; i < std::min(currentInput.size(), word.size()); ++i) {
+            if (currentInput[i] == word[i]) {
                 ++matchLength;
             } else {
                 break;
             }
         }
+        return matchLength;
+    }
 
-        std::string matchedPart = word.substr(0, matchLength);
-        std::string remainingPart = word.substr(matchLength);
+    const std::vector<std::string>& dictionary;
+    std::mt19937 rng;
+    float maxWordWidth;
+    sf::Vector2f size;
+    std::vector<Word> words;
+    std::uint64_t nextWordId = 0;
+    std::string currentInput;
+    int counter = 0;
+    int lives = 3;
+    GameState state = PLAYING;
+    bool scoreRecorded = false;
+};
 
-        matchedText.setString(matchedPart);
-        text.setString(remainingPart);
+// Keeps a pair of sf::Text objects per falling word. Rebuilding text geometry is the expensive
+// part of drawing a word, so it only happens when the word's highlight or the font changes.
+class WordTextCache {
+public:
+    void draw(sf::RenderTarget& target, const GameSession& session, const sf::Font& font, int fontSize) {
+        // the settings screen assigns other fonts into the same sf::Font, so compare the family too
+        if (&font != lastFont || fontSize != lastFontSize || font.getInfo().family != lastFamily) {
+            entries.clear();
+            lastFont = &font;
+            lastFontSize = fontSize;
+            lastFamily = font.getInfo().family;
+        }
 
-        float matchedWidth = matchedText.getGlobalBounds().width;
-        text.setPosition(position.x + matchedWidth, position.y);
-    }
+        std::size_t kept = 0;
+        std::size_t next = 0;
+        for (const auto& word : session.getWords()) {
+            // words are only appended, with rising ids, so entries of removed words are skipped over
+            while (next < entries.size() && entries[next].id < word.id) {
+                ++next;
+            }
 
-    void changeFont(const sf::Font& newFont) {
-        text.setFont(newFont);
-        matchedText.setFont(newFont);
-    }
+            if (next < entries.size() && entries[next].id == word.id) {
+                if (kept != next) {
+                    entries[kept] = std::move(entries[next]);
+                }
+                ++next;
+            } else {
+                next = entries.size();
+                Entry entry{word.id, std::string::npos, 0.0f,
+                            sf::Text("", font, fontSize), sf::Text("", font, fontSize)};
+                entry.text.setFillColor(sf::Color::White);
+                entry.matchedText.setFillColor(sf::Color::Green);
+                if (kept < entries.size()) {
+                    entries[kept] = std::move(entry);
+                } else {
+                    entries.push_back(std::move(entry));
+                    ++next;
+                }
+            }
 
-    void changeFontSize(int newFontSize) {
-        text.setCharacterSize(newFontSize);
-        matchedText.setCharacterSize(newFontSize);
+            Entry& entry = entries[kept++];
+            if (entry.matchLength != word.matchLength) {
+                const std::string& letters = session.getWord(word);
+                entry.matchLength = word.matchLength;
+                entry.matchedText.setString(letters.substr(0, word.matchLength));
+                entry.text.setString(letters.substr(word.matchLength));
+                entry.matchedWidth = entry.matchedText.getGlobalBounds().width;
+            }
+
+            entry.matchedText.setPosition(word.position);
+            entry.text.setPosition(word.position.x + entry.matchedWidth, word.position.y);
+            target.draw(entry.text);
+            target.draw(entry.matchedText);
+        }
+        entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(kept), entries.end());
     }
 
 private:
-    std::string word;
-    sf::Vector2f position;
-    sf::Text text;
-    sf::Text matchedText;
-    float speed;
-    int fontSize;
+    struct Entry {
+        std::uint64_t id;
+        std::size_t matchLength;
+        float matchedWidth;
+        sf::Text text;
+        sf::Text matchedText;
+    };
+
+    std::vector<Entry> entries;
+    const sf::Font* lastFont = nullptr;
+    int lastFontSize = 0;
+    std::string lastFamily;
 };
 
-void saveGameState(int score, int lives, const std::vector<FallingWord>& fallingWords, const sf::Font& currentFont, int currentFontSize) {
+void saveGameState(const GameSession& session, const sf::Font& currentFont, int currentFontSize) {
     std::ofstream file("assets//save.txt");
     if (!file) {
         fmt::print("Failed to open save file.\n");
         return;
     }
 
-    file << score << '\n';
-    file << lives << '\n';
+    file << session.getScore() << '\n';
+    file << session.getLives() << '\n';
     file << currentFontSize << '\n';
 
     // Save font file name
     std::string fontFileName = (currentFont.getInfo().family == "Arial") ? "arial.ttf" : "8BitFont.ttf";
     file << fontFileName << '\n';
 
-    for (const auto& word : fallingWords) {
-        file << word.getWord() << ' ' <<
-             word.getText().getPosition().x << ' ' <<
-             word.getText().getPosition().y << ' ' <<
-             word.getSpeed() << '\n';
+    for (const auto& word : session.getWords()) {
+        file << session.getWord(word) << ' ' <<
+             word.position.x << ' ' <<
+             word.position.y << ' ' <<
+             word.speed << '\n';
     }
 }
 
-void loadSave(int &score, int &lives, std::vector<FallingWord>& fallingWords, sf::Font& currentFont, int& currentFontSize) {
+void loadSave(GameSession& session, sf::Font& currentFont, int& currentFontSize) {
     std::ifstream file("assets//save.txt");
     if (!file) {
         fmt::print("Failed to open save file.\n");
         return;
     }
 
+    int score, lives;
     file >> score;
     file >> lives;
     file >> currentFontSize;
@@ -167,24 +370,818 @@ void loadSave(int &score, int &lives, std::vector<FallingWord>& fallingWords, sf
         fmt::print("Failed to load font {}\n", fontFileName);
     }
 
-    fallingWords.clear();
+    session.restore(score, lives);
 
+    const auto& dictionary = session.getDictionary();
     std::string word;
     float x, y, speed;
     while (file >> word >> x >> y >> speed) {
-        fallingWords.emplace_back(word, x, y, currentFont, speed, currentFontSize);
+        auto it = std::ranges::find(dictionary, word);
+        if (it == dictionary.end()) {
+            fmt::print("Skipping saved word {} that is not in the word list\n", word);
+            continue;
+        }
+        session.addWord(static_cast<std::size_t>(it - dictionary.begin()), {x, y}, speed);
+    }
+}
+
+void drawPlayingScene(sf::RenderTarget& target, const sf::Sprite& bgGame, const sf::RectangleShape& pauseButton,
+                      const sf::Text& textPause, const GameSession& session, WordTextCache& wordTexts,
+                      const sf::Font& currentFont, int currentFontSize, const sf::Font& bitFont) {
+    target.draw(bgGame);
+    target.draw(pauseButton);
+    target.draw(textPause);
+
+    sf::RectangleShape line({static_cast<float>(target.getSize().x), 4});
+    line.setPosition(0, target.getSize().y - 100);
+    line.setFillColor(sf::Color::White);
+    target.draw(line);
+
+    wordTexts.draw(target, session, currentFont, currentFontSize);
+
+    sf::Text inputText(session.getInput(), bitFont, 24);
+    sf::FloatRect inputBounds = inputText.getGlobalBounds();
+
+    float xPos = (target.getSize().x - inputBounds.width) / 2;
+    float yPos = target.getSize().y - 75;
+
+    inputText.setPosition(xPos, yPos);
+    inputText.setFillColor(sf::Color::White);
+    target.draw(inputText);
+
+    sf::Text wordCountText("Score: " + std::to_string(session.getScore()), bitFont, 24);
+    wordCountText.setPosition(10, target.getSize().y - 75);
+    wordCountText.setFillColor(sf::Color::White);
+    target.draw(wordCountText);
+
+    sf::Text livesText("Lives: " + std::to_string(session.getLives()), bitFont, 24);
+    livesText.setPosition(1600, target.getSize().y - 75);
+    livesText.setFillColor(sf::Color::White);
+    target.draw(livesText);
+}
+
+void printFrameStats(const std::string& label, std::vector<float> frameTimes) {
+    std::ranges::sort(frameTimes);
+
+    float total = 0.0f;
+    for (float time : frameTimes) {
+        total += time;
+    }
+
+    fmt::print("  {:<8} avg {:8.3f} ms  p50 {:8.3f} ms  p95 {:8.3f} ms  max {:8.3f} ms\n",
+               label,
+               total / frameTimes.size(),
+               frameTimes[frameTimes.size() / 2],
+               frameTimes[frameTimes.size() * 95 / 100],
+               frameTimes.back());
+}
+
+// Backspaces and types through the session's own input handling until it holds `input`.
+void typeBenchInput(GameSession& session, const std::string& input) {
+    while (!input.starts_with(session.getInput())) {
+        session.handleText('\b');
+    }
+    while (session.getInput().size() < input.size()) {
+        session.handleText(static_cast<unsigned char>(input[session.getInput().size()]));
+    }
+}
+
+// Draws scripted PLAYING scenes into an offscreen texture so renderer changes can be compared
+// without a window or vsync, e.g. `xvfb-run ./pjc --render-bench 300`.
+int runRenderBench(const std::vector<std::string>& wordList, unsigned int frames) {
+    const unsigned int benchWidth = 1920;
+    const unsigned int benchHeight = 1080;
+    const int fontSize = 24;
+
+    if (wordList.empty()) {
+        fmt::print("Render bench needs a word list\n");
+        return -1;
+    }
+
+    sf::Font bitFont;
+    if (!bitFont.loadFromFile("assets//8BitFont.ttf")) {
+        fmt::print("Failed to load 8BitFont.ttf\n");
+        return -1;
+    }
+
+    sf::Texture bgGameTexture;
+    if (!bgGameTexture.loadFromFile("assets//backgroundProjectGame.jpg")) {
+        fmt::print("Failed to load backgroundProjectGame.jpg\n");
+        return -1;
+    }
+
+    sf::RenderTexture target;
+    if (!target.create(benchWidth, benchHeight)) {
+        fmt::print("Failed to create {}x{} render texture\n", benchWidth, benchHeight);
+        return -1;
+    }
+
+    sf::Sprite bgGame;
+    bgGame.setTexture(bgGameTexture);
+
+    auto textPause = sf::Text("PAUSE", bitFont, 30);
+    textPause.setPosition({0, 10});
+    textPause.setFillColor(sf::Color::White);
+
+    auto pauseButton = sf::RectangleShape(sf::Vector2f(150, 45));
+    pauseButton.setPosition({0, 0});
+    pauseButton.setFillColor(sf::Color::Transparent);
+
+    fmt::print("Render bench: {}x{} offscreen, {} frames per scene\n", benchWidth, benchHeight, frames);
+
+    for (int wordCount : {100, 1000, 10000}) {
+        // std::mt19937 produces the same sequence with every standard library, unlike rand(),
+        // so each scene has identical words and positions on every build machine
+        std::mt19937 rng(static_cast<unsigned int>(wordCount));
+
+        GameSession session(wordList, static_cast<unsigned int>(wordCount));
+        session.setSize({static_cast<float>(benchWidth), static_cast<float>(benchHeight)});
+        for (int i = 0; i < wordCount; ++i) {
+            float x = static_cast<float>(rng() % (benchWidth - 150));
+            float y = static_cast<float>(rng() % (benchHeight - 100));
+            session.addWord(rng() % wordList.size(), {x, y}, 0.0f);
+        }
+        WordTextCache wordTexts;
+
+        // typing out one of the words walks every highlight state: nothing matched,
+        // partial prefixes shared by many words, and a full match
+        const std::string script = session.getWord(session.getWords().front());
+
+        std::vector<float> updateTimes;
+        std::vector<float> submitTimes;
+        updateTimes.reserve(frames);
+        submitTimes.reserve(frames);
+
+        // untimed frame so glyph loading does not land in the first sample
+        typeBenchInput(session, script);
+        session.advance(0.0f);
+        target.clear();
+        drawPlayingScene(target, bgGame, pauseButton, textPause, session, wordTexts, bitFont, fontSize, bitFont);
+        target.display();
+        // reading the pixels back blocks until the GPU has finished every queued frame
+        target.getTexture().copyToImage();
+
+        // "submit" is CPU-side time only: building and queueing the frame's draw calls.
+        // The driver may still be rendering it when display() returns.
+        sf::Clock clock;
+        sf::Clock totalClock;
+        for (unsigned int frame = 0; frame < frames; ++frame) {
+            typeBenchInput(session, script.substr(0, frame % (script.size() + 1)));
+
+            clock.restart();
+            session.advance(1.0f / 60.0f);
+            updateTimes.push_back(clock.restart().asMicroseconds() / 1000.0f);
+
+            target.clear();
+            drawPlayingScene(target, bgGame, pauseButton, textPause, session, wordTexts, bitFont, fontSize, bitFont);
+            target.display();
+            submitTimes.push_back(clock.restart().asMicroseconds() / 1000.0f);
+        }
+        // wait for the GPU so throughput counts rendered frames, not queued ones
+        target.getTexture().copyToImage();
+        float totalSeconds = totalClock.getElapsedTime().asSeconds();
+
+        fmt::print("{} words:\n", wordCount);
+        printFrameStats("update", updateTimes);
+        printFrameStats("submit", submitTimes);
+        fmt::print("  {:.1f} frames/s, {:.0f} words/s\n",
+                   frames / totalSeconds,
+                   static_cast<float>(frames) * wordCount / totalSeconds);
+    }
+    return 0;
+}
+
+// Fixed set of worker threads running one indexed job at a time. The calling thread takes part
+// too, and parallelFor returns once every index has been processed.
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t threadCount) {
+        for (std::size_t i = 0; i < threadCount; ++i) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& function) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &function;
+            jobCount = count;
+            nextIndex = 0;
+            pendingWorkers = workers.size();
+            ++generation;
+        }
+        wake.notify_all();
+
+        runJob(function, count);
+
+        // every worker checks out of this generation before the job can be replaced
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return pendingWorkers == 0; });
+        job = nullptr;
+    }
+
+private:
+    void workerLoop() {
+        std::size_t seenGeneration = 0;
+        while (true) {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) {
+                return;
+            }
+            seenGeneration = generation;
+            const auto* function = job;
+            std::size_t count = jobCount;
+            lock.unlock();
+
+            runJob(*function, count);
+
+            lock.lock();
+            if (--pendingWorkers == 0) {
+                done.notify_one();
+            }
+        }
+    }
+
+    void runJob(const std::function<void(std::size_t)>& function, std::size_t count) {
+        for (std::size_t i = nextIndex++; i < count; i = nextIndex++) {
+            function(i);
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(std::size_t)>* job = nullptr;
+    std::size_t jobCount = 0;
+    std::atomic<std::size_t> nextIndex = 0;
+    std::size_t pendingWorkers = 0;
+    std::size_t generation = 0;
+    bool stopping = false;
+};
+
+// Glyphs of one font size, captured once on the main thread so lanes can lay out text on
+// worker threads without going through sf::Font, whose glyph cache is not thread safe.
+struct GlyphAtlas {
+    const sf::Texture* texture = nullptr;
+    std::array<sf::Glyph, 128> glyphs;
+    unsigned int characterSize = 0;
+};
+
+GlyphAtlas buildGlyphAtlas(const sf::Font& font, unsigned int characterSize) {
+    GlyphAtlas atlas;
+    for (std::uint32_t c = 0; c < atlas.glyphs.size(); ++c) {
+        atlas.glyphs[c] = font.getGlyph(c, characterSize, false);
+    }
+    atlas.texture = &font.getTexture(characterSize);
+    atlas.characterSize = characterSize;
+    return atlas;
+}
+
+const sf::Glyph& getAtlasGlyph(const GlyphAtlas& atlas, char c) {
+    return atlas.glyphs[static_cast<unsigned char>(c) % atlas.glyphs.size()];
+}
+
+float measureText(const GlyphAtlas& atlas, std::string_view text) {
+    float width = 0.0f;
+    for (char c : text) {
+        width += getAtlasGlyph(atlas, c).advance;
+    }
+    return width;
+}
+
+void appendQuad(std::vector<sf::Vertex>& vertices, const sf::FloatRect& rect, const sf::FloatRect& texRect, sf::Color color) {
+    float right = rect.left + rect.width;
+    float bottom = rect.top + rect.height;
+    float texRight = texRect.left + texRect.width;
+    float texBottom = texRect.top + texRect.height;
+
+    sf::Vertex topLeft({rect.left, rect.top}, color, {texRect.left, texRect.top});
+    sf::Vertex topRight({right, rect.top}, color, {texRight, texRect.top});
+    sf::Vertex bottomLeft({rect.left, bottom}, color, {texRect.left, texBottom});
+    sf::Vertex bottomRight({right, bottom}, color, {texRight, texBottom});
+
+    vertices.push_back(topLeft);
+    vertices.push_back(topRight);
+    vertices.push_back(bottomLeft);
+    vertices.push_back(bottomLeft);
+    vertices.push_back(topRight);
+    vertices.push_back(bottomRight);
+}
+
+// Solid rectangles sample the white pixels SFML reserves in the corner of every font texture.
+void appendRect(std::vector<sf::Vertex>& vertices, const sf::FloatRect& rect, sf::Color color) {
+    appendQuad(vertices, rect, sf::FloatRect(1, 1, 0, 0), color);
+}
+
+// Lays text out like sf::Text (position is the top-left corner, no kerning) and returns
+// the x coordinate right after the last glyph. Glyphs that would cross `clipRight` are left
+// out, as the whole batch is drawn without a per-lane scissor.
+float appendText(std::vector<sf::Vertex>& vertices, const GlyphAtlas& atlas, std::string_view text,
+                 sf::Vector2f position, sf::Color color, float clipRight) {
+    const float padding = 1.0f;
+    float x = position.x;
+    float baseline = position.y + static_cast<float>(atlas.characterSize);
+
+    for (char c : text) {
+        const sf::Glyph& glyph = getAtlasGlyph(atlas, c);
+        if (x + glyph.advance > clipRight) {
+            break;
+        }
+        if (glyph.textureRect.width > 0) {
+            sf::FloatRect texRect(glyph.textureRect);
+            appendQuad(vertices,
+                       sf::FloatRect(x + glyph.bounds.left - padding, baseline + glyph.bounds.top - padding,
+                                     glyph.bounds.width + 2 * padding, glyph.bounds.height + 2 * padding),
+                       sf::FloatRect(texRect.left - padding, texRect.top - padding,
+                                     texRect.width + 2 * padding, texRect.height + 2 * padding),
+                       color);
+        }
+        x += glyph.advance;
+    }
+    return x;
+}
+
+// A character typed on one physical keyboard, translated like sf::Event::TextEntered.
+struct KeyboardText {
+    std::size_t keyboard;
+    std::uint32_t unicode;
+};
+
+// Reads every keyboard on its own, which SFML cannot do as it merges them into one stream.
+// Only Linux evdev is implemented, with a US layout. Elsewhere, or without read access to
+// /dev/input/event* (usually the `input` group), open() finds no keyboards.
+class KeyboardDevices {
+public:
+    KeyboardDevices() = default;
+
+    ~KeyboardDevices() {
+#ifdef __linux__
+        for (const auto& device : devices) {
+            if (device.fd >= 0) {
+                ::close(device.fd);
+            }
+        }
+#endif
+    }
+
+    KeyboardDevices(const KeyboardDevices&) = delete;
+    KeyboardDevices& operator=(const KeyboardDevices&) = delete;
+
+    // Returns how many keyboards were found; they are numbered in /dev/input order.
+    std::size_t open() {
+#ifdef __linux__
+        std::vector<std::string> paths;
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator("/dev/input", error)) {
+            if (entry.path().filename().string().starts_with("event")) {
+                paths.push_back(entry.path().string());
+            }
+        }
+        std::ranges::sort(paths);
+
+        for (const auto& path : paths) {
+            int fd = ::open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+            if (fd < 0) {
+                continue;
+            }
+
+            // mice, power buttons and the extra nodes of media keys have no letter keys
+            unsigned long keyBits[KEY_MAX / (8 * sizeof(unsigned long)) + 1] = {};
+            if (ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keyBits)), keyBits) < 0 ||
+                !hasKey(keyBits, KEY_A) || !hasKey(keyBits, KEY_Z) || !hasKey(keyBits, KEY_ENTER)) {
+                ::close(fd);
+                continue;
+            }
+            devices.push_back({fd, false});
+        }
+        return devices.size();
+#else
+        return 0;
+#endif
+    }
+
+    // Appends what was typed since the last call; never blocks.
+    void poll(std::vector<KeyboardText>& typed) {
+#ifdef __linux__
+        input_event events[64];
+        for (std::size_t i = 0; i < devices.size(); ++i) {
+            Device& device = devices[i];
+            ssize_t bytes = 0;
+            while (device.fd >= 0 && (bytes = ::read(device.fd, events, sizeof(events))) > 0) {
+                for (std::size_t j = 0; j < static_cast<std::size_t>(bytes) / sizeof(input_event); ++j) {
+                    const input_event& event = events[j];
+                    if (event.type != EV_KEY) {
+                        continue;
+                    }
+                    if (event.code == KEY_LEFTSHIFT || event.code == KEY_RIGHTSHIFT) {
+                        device.shift = event.value != 0;
+                    } else if (event.value != 0) { // press or auto-repeat
+                        std::uint32_t unicode = translateKey(event.code, device.shift);
+                        if (unicode != 0) {
+                            typed.push_back({i, unicode});
+                        }
+                    }
+                }
+            }
+            if (device.fd >= 0 && bytes < 0 && errno != EAGAIN) { // unplugged
+                ::close(device.fd);
+                device.fd = -1;
+            }
+        }
+#else
+        (void) typed;
+#endif
+    }
+
+private:
+#ifdef __linux__
+    struct Device {
+        int fd;
+        bool shift;
+    };
+
+    static bool hasKey(const unsigned long* keyBits, unsigned int key) {
+        const std::size_t bitsPerWord = 8 * sizeof(unsigned long);
+        return (keyBits[key / bitsPerWord] >> (key % bitsPerWord)) & 1;
+    }
+
+    static std::uint32_t translateKey(unsigned int code, bool shift) {
+        // each row of a US keyboard has consecutive key codes
+        struct KeyRow {
+            unsigned int firstKey;
+            std::string_view keys;
+            std::string_view shiftedKeys;
+        };
+        static constexpr KeyRow rows[] = {
+                {KEY_1, "1234567890-=", "!@#$%^&*()_+"},
+                {KEY_Q, "qwertyuiop[]", "QWERTYUIOP{}"},
+                {KEY_A, "asdfghjkl;'`", "ASDFGHJKL:\"~"},
+                {KEY_Z, "zxcvbnm,./", "ZXCVBNM<>?"},
+        };
+
+        switch (code) {
+            case KEY_BACKSPACE:
+                return '\b';
+            case KEY_ENTER:
+            case KEY_KPENTER:
+                return '\r';
+            case KEY_SPACE:
+                return ' ';
+            default:
+                break;
+        }
+
+        for (const auto& row : rows) {
+            if (code >= row.firstKey && code < row.firstKey + row.keys.size()) {
+                return static_cast<unsigned char>((shift ? row.shiftedKeys : row.keys)[code - row.firstKey]);
+            }
+        }
+        return 0;
+    }
+
+    std::vector<Device> devices;
+#endif
+};
+
+// One player's spot on the classroom screen. Game rules live in the session; the lane adds
+// where it sits in the window and its share of the frame's vertex batch.
+struct Lane {
+    GameSession session;
+    std::string label;
+    sf::FloatRect bounds;
+    std::vector<sf::Vertex> vertices;
+    bool hasKeyboard = false;
+};
+
+// Enter starts a finished game again; everything else goes to the game itself.
+void typeIntoLane(Lane& lane, std::uint32_t unicode) {
+    if (lane.session.isGameOver()) {
+        if (unicode == '\r') {
+            lane.session.restart();
+        }
+    } else {
+        lane.session.handleText(unicode);
+    }
+}
+
+// Left edge that centres `width` in the lane, kept inside the lane's margin when it is wider.
+float getCentredX(const sf::FloatRect& bounds, float width) {
+    return bounds.left + std::max(10.0f, (bounds.width - width) / 2);
+}
+
+// Short lines centred on the middle of the lane, 30px apart.
+void appendMessage(std::vector<sf::Vertex>& vertices, const GlyphAtlas& atlas, const sf::FloatRect& bounds,
+                   std::span<const std::string_view> lines, sf::Color color) {
+    float y = bounds.top + bounds.height / 2 - 15.0f * static_cast<float>(lines.size());
+    for (std::string_view line : lines) {
+        appendText(vertices, atlas, line, {getCentredX(bounds, measureText(atlas, line)), y},
+                   color, bounds.left + bounds.width);
+        y += 30;
     }
 }
 
-auto main() -> int {
+// Runs on a worker thread; only reads the shared dictionary and atlas. Everything is laid out
+// to fit a minLaneSize lane: the input gets its own row above the score/lives row, and
+// messages are split over short lines. A lane that is not active shows `idleLines`.
+void buildLaneVertices(Lane& lane, const GlyphAtlas& atlas, bool active, std::span<const std::string_view> idleLines) {
+    const GameSession& session = lane.session;
+    const sf::FloatRect& bounds = lane.bounds;
+    std::vector<sf::Vertex>& vertices = lane.vertices;
+    vertices.clear();
+
+    sf::Color laneColor = active ? sf::Color::Green : sf::Color::White;
+    float bottom = bounds.top + bounds.height;
+    float right = bounds.left + bounds.width;
+
+    if (bounds.left > 0) {
+        appendRect(vertices, sf::FloatRect(bounds.left, bounds.top, 2, bounds.height), sf::Color::White);
+    }
+    if (bounds.top > 0) {
+        appendRect(vertices, sf::FloatRect(bounds.left, bounds.top, bounds.width, 2), sf::Color::White);
+    }
+    appendText(vertices, atlas, lane.label, {bounds.left + 10, bounds.top + 10}, laneColor, right);
+    appendRect(vertices, sf::FloatRect(bounds.left, bottom - 100, bounds.width, 4), laneColor);
+
+    if (session.isGameOver()) {
+        static constexpr std::string_view gameOverLines[] = {"Game Over!", "Press Enter"};
+        appendMessage(vertices, atlas, bounds, gameOverLines, sf::Color::Red);
+    } else if (!active) {
+        appendMessage(vertices, atlas, bounds, idleLines, sf::Color::White);
+    } else {
+        for (const auto& word : session.getWords()) {
+            std::string_view text = session.getWord(word);
+            float x = appendText(vertices, atlas, text.substr(0, word.matchLength),
+                                 {bounds.left + word.position.x, bounds.top + word.position.y}, sf::Color::Green, right);
+            appendText(vertices, atlas, text.substr(word.matchLength),
+                       {x, bounds.top + word.position.y}, sf::Color::White, right);
+        }
+    }
+
+    appendText(vertices, atlas, session.getInput(),
+               {getCentredX(bounds, measureText(atlas, session.getInput())), bottom - 88}, sf::Color::White, right);
+
+    std::string scoreText = "Score: " + std::to_string(session.getScore());
+    appendText(vertices, atlas, scoreText, {bounds.left + 10, bottom - 48}, sf::Color::White, right);
+
+    std::string livesText = "Lives: " + std::to_string(session.getLives());
+    appendText(vertices, atlas, livesText,
+               {right - measureText(atlas, livesText) - 10, bottom - 48}, sf::Color::White, right);
+}
+
+// Smallest lane that still fits the longest word and the score/lives row at character size 24.
+const sf::Vector2f minLaneSize(480, 360);
+
+// Lanes form a grid with as many columns as rows, or one more.
+std::size_t getLaneColumns(std::size_t laneCount) {
+    return static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(laneCount))));
+}
+
+sf::Vector2f getLaneSize(std::size_t laneCount, float width, float height) {
+    std::size_t columns = getLaneColumns(laneCount);
+    std::size_t rows = (laneCount + columns - 1) / columns;
+    return {width / static_cast<float>(columns), height / static_cast<float>(rows)};
+}
+
+void layoutLanes(std::vector<Lane>& lanes, float width, float height) {
+    std::size_t columns = getLaneColumns(lanes.size());
+    sf::Vector2f laneSize = getLaneSize(lanes.size(), width, height);
+    float laneWidth = laneSize.x;
+    float laneHeight = laneSize.y;
+
+    for (std::size_t i = 0; i < lanes.size(); ++i) {
+        lanes[i].bounds = sf::FloatRect(static_cast<float>(i % columns) * laneWidth,
+                                        static_cast<float>(i / columns) * laneHeight,
+                                        laneWidth, laneHeight);
+        lanes[i].session.setSize({laneWidth, laneHeight});
+    }
+}
+
+// Classroom mode: several independent games in one window, one per keyboard. A keyboard joins
+// the next free lane by pressing Enter, and every joined lane runs at once on a thread pool.
+// When keyboards cannot be read one by one, all typing goes to the focused lane (F1-F12, Tab
+// or a mouse click) and the other lanes wait, paused. The whole frame is drawn as one vertex
+// batch over the background.
+int runLanes(const std::vector<std::string>& wordList, std::size_t laneCount) {
+    if (wordList.empty()) {
+        fmt::print("Lanes mode needs a word list\n");
+        return -1;
+    }
+
+    sf::VideoMode desktopMode = sf::VideoMode::getDesktopMode();
+    sf::Vector2f laneSize = getLaneSize(laneCount, static_cast<float>(desktopMode.width), static_cast<float>(desktopMode.height));
+    if (laneSize.x < minLaneSize.x || laneSize.y < minLaneSize.y) {
+        fmt::print("{} lanes would be {}x{} on this {}x{} screen, each lane needs at least {}x{}\n",
+                   laneCount, laneSize.x, laneSize.y, desktopMode.width, desktopMode.height, minLaneSize.x, minLaneSize.y);
+        return -1;
+    }
+
     loadScores();
+    sf::RenderWindow window(desktopMode, "Dragon Typer", sf::Style::Close | sf::Style::Resize);
+    window.setFramerateLimit(60);
+
+    sf::Font bitFont;
+    if (!bitFont.loadFromFile("assets//8BitFont.ttf")) {
+        fmt::print("Failed to load 8BitFont.ttf\n");
+        return -1;
+    }
+
+    sf::Texture bgGameTexture;
+    if (!bgGameTexture.loadFromFile("assets//backgroundProjectGame.jpg")) {
+        fmt::print("Failed to load backgroundProjectGame.jpg\n");
+        return -1;
+    }
+
+    sf::Sprite bgGame;
+    bgGame.setTexture(bgGameTexture);
+
+    sf::View view(sf::FloatRect(0, 0,
+                                static_cast<float>(desktopMode.width),
+                                static_cast<float>(desktopMode.height)));
+
+    const GlyphAtlas atlas = buildGlyphAtlas(bitFont, 24);
+
+    float longestWordWidth = 0.0f;
+    for (const auto& word : wordList) {
+        longestWordWidth = std::max(longestWordWidth, measureText(atlas, word));
+    }
+
+    auto seed = static_cast<unsigned int>(time(nullptr));
+    std::vector<Lane> lanes;
+    lanes.reserve(laneCount);
+    for (std::size_t i = 0; i < laneCount; ++i) {
+        lanes.push_back(Lane{GameSession(wordList, seed + static_cast<unsigned int>(i), longestWordWidth), "P" + std::to_string(i + 1), {}, {}, false});
+    }
+    layoutLanes(lanes, static_cast<float>(desktopMode.width), static_cast<float>(desktopMode.height));
+
+    std::size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    ThreadPool pool(std::min(laneCount, hardwareThreads) - 1);
+
+    KeyboardDevices keyboards;
+    std::size_t keyboardCount = keyboards.open();
+    bool perKeyboard = keyboardCount > 0;
+    std::vector<std::string_view> idleLines;
+    if (perKeyboard) {
+        fmt::print("Found {} keyboards, press Enter on one to join a lane\n", keyboardCount);
+        idleLines = {"Press Enter", "to join"};
+    } else {
+        fmt::print("Cannot read keyboards one by one (Linux needs read access to /dev/input), "
+                   "sharing one keyboard: only the focused lane runs\n");
+        idleLines = {"PAUSED"};
+    }
+    // lanes.size() marks a keyboard that has not joined a lane yet
+    std::vector<std::size_t> keyboardLanes(keyboardCount, lanes.size());
+    std::vector<KeyboardText> typed;
+
+    std::size_t focusedLane = 0;
+    std::vector<sf::Vertex> batch;
+    sf::Clock clock;
+
+    while (window.isOpen()) {
+
+        auto event = sf::Event();
+        while (window.pollEvent(event)) {
+            switch (event.type) {
+                case sf::Event::Closed:
+                    window.close();
+                    break;
+
+                case sf::Event::MouseButtonPressed:
+                    if (!perKeyboard && event.mouseButton.button == sf::Mouse::Left) {
+                        for (std::size_t i = 0; i < lanes.size(); ++i) {
+                            if (lanes[i].bounds.contains(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y))) {
+                                focusedLane = i;
+                                break;
+                            }
+                        }
+                    }
+                    break;
+
+                case sf::Event::KeyPressed:
+                    if (event.key.code == sf::Keyboard::Escape) {
+                        window.close();
+                    } else if (perKeyboard) {
+                        break;
+                    } else if (event.key.code == sf::Keyboard::Tab) {
+                        focusedLane = (focusedLane + 1) % lanes.size();
+                    } else if (event.key.code >= sf::Keyboard::F1 && event.key.code <= sf::Keyboard::F12) {
+                        auto lane = static_cast<std::size_t>(event.key.code - sf::Keyboard::F1);
+                        if (lane < lanes.size()) {
+                            focusedLane = lane;
+                        }
+                    }
+                    break;
+
+                case sf::Event::TextEntered:
+                    // with per-keyboard input the same keys also arrive here, merged
+                    if (!perKeyboard) {
+                        typeIntoLane(lanes[focusedLane], event.text.unicode);
+                    }
+                    break;
+
+                case sf::Event::Resized:
+                    view.setSize(static_cast<float>(event.size.width), static_cast<float>(event.size.height));
+                    view.setCenter(static_cast<float>(event.size.width) / 2, static_cast<float>(event.size.height) / 2);
+                    layoutLanes(lanes, static_cast<float>(event.size.width), static_cast<float>(event.size.height));
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        typed.clear();
+        keyboards.poll(typed);
+        // keys typed into other windows are read as well, so only use them while focused
+        if (window.hasFocus()) {
+            for (const auto& text : typed) {
+                std::size_t& laneIndex = keyboardLanes[text.keyboard];
+                if (laneIndex < lanes.size()) {
+                    typeIntoLane(lanes[laneIndex], text.unicode);
+                    continue;
+                }
+
+                if (text.unicode != '\r') {
+                    continue;
+                }
+                for (std::size_t i = 0; i < lanes.size(); ++i) {
+                    if (!lanes[i].hasKeyboard) {
+                        lanes[i].hasKeyboard = true;
+                        lanes[i].session.restart();
+                        laneIndex = i;
+                        break;
+                    }
+                }
+            }
+        }
+
+        float deltaTime = clock.restart().asSeconds();
+        pool.parallelFor(lanes.size(), [&](std::size_t i) {
+            bool active = perKeyboard ? lanes[i].hasKeyboard : i == focusedLane;
+            if (active) {
+                lanes[i].session.update(deltaTime);
+            }
+            buildLaneVertices(lanes[i], atlas, active, idleLines);
+        });
+
+        batch.clear();
+        for (auto& lane : lanes) {
+            int score;
+            if (lane.session.takeFinalScore(score)) {
+                scores.push_back(score);
+                saveScores();
+            }
+            batch.insert(batch.end(), lane.vertices.begin(), lane.vertices.end());
+        }
+
+        window.clear();
+        window.setView(view);
+        window.draw(bgGame);
+        window.draw(batch.data(), batch.size(), sf::Triangles, sf::RenderStates(atlas.texture));
+        window.display();
+    }
+    return 0;
+}
+
+auto main(int argc, char* argv[]) -> int {
     std::vector<std::string> wordList = loadWords("assets/words.txt");
+    if (argc > 1 && std::string(argv[1]) == "--render-bench") {
+        long frames = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 300;
+        if (frames < 1 || frames > 100000) {
+            fmt::print("Usage: pjc --render-bench [frames], frames must be between 1 and 100000\n");
+            return -1;
+        }
+        return runRenderBench(wordList, static_cast<unsigned int>(frames));
+    }
+    if (argc > 1 && std::string(argv[1]) == "--lanes") {
+        long laneCount = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 2;
+        if (laneCount < 1 || laneCount > 12) {
+            fmt::print("Usage: pjc --lanes [count], count must be between 1 and 12 (one per F1-F12 key)\n");
+            return -1;
+        }
+        return runLanes(wordList, static_cast<std::size_t>(laneCount));
+    }
+
+    loadScores();
     sf::VideoMode desktopMode = sf::VideoMode::getDesktopMode();
     sf::RenderWindow window(desktopMode, "Dragon Typer", sf::Style::Close | sf::Style::Resize);
     window.setFramerateLimit(60);
 
-    int counter = 0;
-
     sf::Font arial;
     if (!arial.loadFromFile("assets//arial.ttf")) {
         fmt::print("Failed to load arial.ttf\n");
@@ -343,11 +1340,10 @@ auto main() -> int {
 
     GameState gameState = MENU;
 
-    std::vector<FallingWord> fallingWords;
-    std::string currentInput;
+    GameSession session(wordList, static_cast<unsigned int>(time(nullptr)));
+    session.setSize({static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)});
+    WordTextCache wordTexts;
     sf::Clock clock;
-    srand(static_cast<unsigned int>(time(nullptr)));
-    int lives;
 
     sf::Sprite bgMenu;
     bgMenu.setTexture(bgMenuTexture);
@@ -371,11 +1367,8 @@ auto main() -> int {
                                 window.close();
                             } else if (startButton.getGlobalBounds().contains({static_cast<float>(mousePos.x), static_cast<float>(mousePos.y)})) {
                                 gameState = PLAYING;
-                                fallingWords.clear();
-                                currentInput.clear();
+                                session.restart();
                                 clock.restart();
-                                counter = 0;
-                                lives = 3;
                                 change = true;
                             } else if (scoreButton.getGlobalBounds().contains({static_cast<float>(mousePos.x), static_cast<float>(mousePos.y)})) {
                                 gameState = SCOREBOARD;
@@ -389,7 +1382,7 @@ auto main() -> int {
                                     break;
                                 }
 
-                                loadSave(counter, lives, fallingWords, currentFont, currentFontSize);
+                                loadSave(session, currentFont, currentFontSize);
                                 gameState = PLAYING;
                                 clock.restart();
                                 change = true;
@@ -402,7 +1395,7 @@ auto main() -> int {
                             change = true;
                         } else if (gameState == PLAYING){
                             if(pauseButton.getGlobalBounds().contains({static_cast<float>(mousePos.x), static_cast<float>(mousePos.y)})){
-                                saveGameState(counter, lives, fallingWords, currentFont, currentFontSize);
+                                saveGameState(session, currentFont, currentFontSize);
                                 gameState = PAUSED;
                                 change = true;
                             }
@@ -411,9 +1404,9 @@ auto main() -> int {
                                 gameState = MENU;
                                 change = true;
                             } else if (saveText.getGlobalBounds().contains(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y))) {
-                                saveGameState(counter, lives, fallingWords, currentFont, currentFontSize);
+                                saveGameState(session, currentFont, currentFontSize);
                             } else if (resumeText.getGlobalBounds().contains(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y))) {
-                                loadSave(counter, lives, fallingWords, currentFont, currentFontSize);
+                                loadSave(session, currentFont, currentFontSize);
                                 gameState = PLAYING;
                                 clock.restart();
                                 change = true;
@@ -442,15 +1435,9 @@ auto main() -> int {
                             } else if (fontIncreaseButton.getGlobalBounds().contains(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y))) {
                                 currentFontSize = std::min(40, currentFontSize + 1);
                                 change = true;
-                                for (auto& word : fallingWords) {
-                                    word.changeFontSize(currentFontSize);
-                                }
                             } else if (fontDecreaseButton.getGlobalBounds().contains(static_cast<float>(mousePos.x), static_cast<float>(mousePos.y))) {
                                 currentFontSize = std::max(4, currentFontSize - 1);
                                 change = true;
-                                for (auto& word : fallingWords) {
-                                    word.changeFontSize(currentFontSize);
-                                }
                             }
                         }
                     }
@@ -458,28 +1445,7 @@ auto main() -> int {
 
                 case sf::Event::TextEntered:
                     if (gameState == PLAYING) {
-                        if (event.text.unicode == '\b') { // backspace
-                            if (!currentInput.empty()) {
-                                currentInput.pop_back();
-                            }
-                        } else if (event.text.unicode == '\r') { // enter
-                            for (auto it = fallingWords.begin(); it != fallingWords.end(); ++it) {
-                                if (it->getWord() == currentInput) {
-                                    fallingWords.erase(it);
-                                    currentInput.clear();
-                                    if(it->getWord().size() < 6){
-                                        counter++;
-                                    } else if (it->getWord().size() < 10 && it->getWord().size() >= 6){
-                                        counter += 2;
-                                    } else if (it-> getWord().size() >= 10){
-                                        counter += 3;
-                                    }
-                                    break;
-                                }
-                            }
-                        } else if (event.text.unicode < 128) {
-                            currentInput += static_cast<char>(event.text.unicode);
-                        }
+                        session.handleText(event.text.unicode);
                     }
                     break;
 
@@ -487,6 +1453,7 @@ auto main() -> int {
                     view.setSize(static_cast<float>(event.size.width), static_cast<float>(event.size.height));
                     view.setCenter(static_cast<float>(event.size.width) / 2, static_cast<float>(event.size.height) / 2);
                     window.setView(view);
+                    session.setSize({static_cast<float>(event.size.width), static_cast<float>(event.size.height)});
                     change = true;
                     break;
 
@@ -508,32 +1475,9 @@ auto main() -> int {
         }
 
         if (gameState == PLAYING) {
-            float deltaTime = clock.restart().asSeconds();
-
-            if (rand() % std::max(1, 300 - counter * 2) < 1.5) {
-                std::string newWord = getRandomWord(wordList);
-                float x = static_cast<float>(rand() % (window.getSize().x - 150));
-                float speed = 70.0f + counter;
-                fallingWords.emplace_back(newWord, x, 0.0f, bitFont, speed, currentFontSize);
-            }
-
-            for (auto& word : fallingWords) {
-                word.update(deltaTime);
-                word.highlight(currentInput);
-            }
-
-            // collision with the bottom
-            for (auto it = fallingWords.begin(); it != fallingWords.end(); ) {
-                if (it->checkCollision(window.getSize().y)) {
-                    lives--;
-                    if (lives == 0) {
-                        gameState = GAME_OVER;
-                        break;
-                    }
-                    it = fallingWords.erase(it);  // Remove word that reached the bottom
-                } else {
-                    ++it;
-                }
+            session.update(clock.restart().asSeconds());
+            if (session.isGameOver()) {
+                gameState = GAME_OVER;
             }
             change = true;
         }
@@ -557,40 +1501,8 @@ auto main() -> int {
                 window.draw(textQuit);
 
             } else if (gameState == PLAYING) {
-                window.draw(bgGame);
-                window.draw(pauseButton);
-                window.draw(textPause);
-
-                sf::RectangleShape line({static_cast<float>(window.getSize().x), 4});
-                line.setPosition(0, window.getSize().y - 100);
-                line.setFillColor(sf::Color::White);
-                window.draw(line);
-
-                for (auto& word : fallingWords) {
-                    word.changeFont(currentFont);
-                    window.draw(word.getText());
-                    window.draw(word.getMatchedText());
-                }
-
-                sf::Text inputText(currentInput, bitFont, 24);
-                sf::FloatRect inputBounds = inputText.getGlobalBounds();
-
-                float xPos = (window.getSize().x - inputBounds.width) / 2;
-                float yPos = window.getSize().y - 75;
-
-                inputText.setPosition(xPos, yPos);
-                inputText.setFillColor(sf::Color::White);
-                window.draw(inputText);
-
-                sf::Text wordCountText("Score: " + std::to_string(counter), bitFont, 24);
-                wordCountText.setPosition(10, window.getSize().y - 75);
-                wordCountText.setFillColor(sf::Color::White);
-                window.draw(wordCountText);
-
-                sf::Text livesText("Lives: " + std::to_string(lives), bitFont, 24);
-                livesText.setPosition(1600, window.getSize().y - 75);
-                livesText.setFillColor(sf::Color::White);
-                window.draw(livesText);
+                drawPlayingScene(window, bgGame, pauseButton, textPause, session, wordTexts,
+                                 currentFont, currentFontSize, bitFont);
 
             } else if (gameState == GAME_OVER) {
                 sf::Text gameOverText("Game Over! Press any key to return to menu.", bitFont, 35);
@@ -606,8 +1518,11 @@ auto main() -> int {
                 window.draw(bgGame);
                 window.draw(gameOverText);
                 std::ofstream file("assets//save.txt", std::ios::trunc);
-                scores.push_back(counter);
-                saveScores();
+                int finalScore;
+                if (session.takeFinalScore(finalScore)) {
+                    scores.push_back(finalScore);
+                    saveScores();
+                }
 
             } else if (gameState == PAUSED) {
                 window.draw(pauseWindow);